@@ -0,0 +1,97 @@
+#ifndef CONVOLUTION_HPP
+#define CONVOLUTION_HPP
+
+#include "field.hpp"
+#include "fp.hpp"
+#include "polynomial.hpp"
+#include "polynomial_f2.hpp"
+#include <vector>
+#include <span>
+#include <deque>
+#include <future>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include <type_traits>
+
+namespace nttl {
+
+/// \brief 以固定多项式为卷积核的分块流式卷积.
+/// \remarks 输入每满 \c block_size 个系数组成一块, 与卷积核相乘后以 overlap-add 拼接.
+///          至多 \c threads 块同时在计算, 内存占用与输出延迟只取决于块大小, 核长度与线程数.
+template<Field F>
+class StreamConv {
+public:
+    using value_type = F;
+    /// \brief 卷积核预先转换成的多项式, 在 \f$\mathbb{F}_2\f$ 上使用按位压缩的 \c PolyF2.
+    using PolyType = std::conditional_t<std::is_same_v<value_type, Fp<2>>, PolyF2, Poly<value_type>>;
+
+    /// \param kernel     卷积核.
+    /// \param block_size 每块的输入系数个数.
+    /// \param threads    同时计算的块数, 为一时在调用线程上依次计算.
+    StreamConv(const Poly<value_type> &kernel, int block_size, int threads = 1)
+        : kernel_(kernel.cbegin(), kernel.cend()), klen_(std::max(kernel.deg() + 1, 1)),
+          block_size_(block_size), threads_(threads), tail_(klen_ - 1) {
+        if (block_size <= 0 || threads <= 0) throw std::runtime_error("Size error");
+        buf_.reserve(block_size);
+    }
+    StreamConv(const StreamConv &) = delete;
+    StreamConv &operator=(const StreamConv &) = delete;
+
+    /// \brief 输入若干系数.
+    /// \return 已经确定的输出系数, 接在之前的输出之后.
+    auto push(std::span<const value_type> in) {
+        std::vector<value_type> res;
+        for (auto &&i : in) {
+            buf_.push_back(i);
+            if (static_cast<int>(buf_.size()) == block_size_) submit(res);
+        }
+        return res;
+    }
+    /// \brief 结束输入.
+    /// \return 剩余的全部输出系数. 之后可以开始新的一段输入.
+    auto flush() {
+        std::vector<value_type> res;
+        if (!buf_.empty()) submit(res);
+        while (!pending_.empty()) retire(res);
+        // 输入为空时卷积也为空
+        if (started_) res.insert(res.end(), tail_.begin(), tail_.end());
+        tail_.assign(klen_ - 1, value_type{});
+        started_ = false;
+        return res;
+    }
+
+private:
+    /// \brief 将 \c buf_ 作为一块提交计算, 在途的块已满时先取回最早的一块.
+    void submit(std::vector<value_type> &res) {
+        if (static_cast<int>(pending_.size()) == threads_) retire(res);
+        const auto len = static_cast<int>(buf_.size());
+        const auto policy = threads_ == 1 ? std::launch::deferred : std::launch::async;
+        pending_.emplace_back(len, std::async(policy, [this, blk = std::move(buf_)] {
+            return PolyType(blk.cbegin(), blk.cend()) * kernel_;
+        }));
+        buf_.clear();
+        buf_.reserve(block_size_);
+        started_ = true;
+    }
+    /// \brief 取回最早的一块, 与之前的重叠部分相加后输出其前 \c len 个系数.
+    void retire(std::vector<value_type> &res) {
+        auto [len, fut] = std::move(pending_.front());
+        pending_.pop_front();
+        const auto y = fut.get();
+        tail_.resize(len + klen_ - 1);
+        for (auto i = 0, e = y.deg(); i <= e; ++i) tail_[i] += y[i];
+        res.insert(res.end(), tail_.begin(), tail_.begin() + len);
+        tail_.erase(tail_.begin(), tail_.begin() + len);
+    }
+
+    const PolyType kernel_;
+    const int klen_, block_size_, threads_;
+    std::vector<value_type> buf_, tail_; // 未满一块的输入, 尚未输出的重叠部分
+    std::deque<std::pair<int, std::future<PolyType>>> pending_;
+    bool started_ = false;
+};
+
+}
+
+#endif
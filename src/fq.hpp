@@ -4,10 +4,12 @@
 #include "field.hpp"
 #include "polynomial.hpp"
 #include "fp.hpp"
+#include "polynomial_f2.hpp"
 #include <array>
 #include <cstdint>
 #include <utility>
 #include <exception>
+#include <type_traits>
 
 namespace nttl {
 
@@ -28,6 +30,9 @@ public:
 
     static constexpr auto SIZE = static_cast<int>(DEG);
 
+    /// \brief 内部乘法与求逆所用的多项式, 在 \f$\mathbb{F}_2\f$ 上使用按位压缩的 \c PolyF2.
+    using PolyType = std::conditional_t<std::is_same_v<value_type, Fp<2>>, PolyF2, Poly<value_type>>;
+
     static constexpr auto x() { return value_type::x(); }
     static constexpr auto card() { return std::make_pair(x(), static_cast<std::uint32_t>(DEG)); }
 
@@ -54,10 +59,10 @@ public:
     }
     /// \brief 乘法逆元
     constexpr auto inv() const {
-        using P = Poly<value_type>;
+        using P = PolyType;
         if (*this == Fq{}) throw std::runtime_error("Division by zero");
         P iv;
-        std::tie(iv, std::ignore) = P::inv_gcd(*this, P(IrrPoly.cbegin(), IrrPoly.cend()));
+        std::tie(iv, std::ignore) = P::inv_gcd(P(MyBase::cbegin(), MyBase::cend()), P(IrrPoly.cbegin(), IrrPoly.cend()));
         Fq res;
         for (auto i = 0, e = iv.deg(); i <= e; ++i) res[i] = iv[i];
         return res;
@@ -71,8 +76,8 @@ public:
         return (*this);
     }
     constexpr decltype(auto) operator*=(const Fq &rhs) {
-        using P = Poly<value_type>;
-        P res(P(*this) * P(rhs) % P(IrrPoly.cbegin(), IrrPoly.cend()));
+        using P = PolyType;
+        P res(P(MyBase::cbegin(), MyBase::cend()) * P(rhs.cbegin(), rhs.cend()) % P(IrrPoly.cbegin(), IrrPoly.cend()));
         const auto d = res.deg();
         for (auto i = 0; i <= d; ++i) MyBase::operator[](i) = res[i];
         for (auto i = d + 1; i < SIZE; ++i) MyBase::operator[](i) = value_type{}; // 重要!!!
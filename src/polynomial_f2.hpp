@@ -0,0 +1,335 @@
+#ifndef POLYNOMIAL_F2_HPP
+#define POLYNOMIAL_F2_HPP
+
+#include "fp.hpp"
+#include "polynomial.hpp"
+#include <vector>
+#include <cstdint>
+#include <bit>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+#include <iterator>
+#include <iostream>
+#include <exception>
+#include <initializer_list>
+#include <type_traits>
+#if defined(__PCLMUL__)
+#include <wmmintrin.h>
+#endif
+
+namespace nttl {
+
+namespace detail {
+
+/// \brief 64 位无进位乘法, 返回 (低 64 位, 高 64 位).
+/// \remarks 编译时开启 PCLMUL (如 `-mpclmul`) 则使用 `pclmulqdq` 指令, 否则使用 4 位窗口查表.
+constexpr auto clmul64(std::uint64_t a, std::uint64_t b) {
+#if defined(__PCLMUL__)
+    if (!std::is_constant_evaluated()) {
+        const auto r = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)),
+                                            _mm_cvtsi64_si128(static_cast<long long>(b)), 0);
+        return std::make_pair(static_cast<std::uint64_t>(_mm_cvtsi128_si64(r)),
+                              static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r))));
+    }
+#endif
+    std::uint64_t t[16]{0, a};
+    for (auto i = 2; i != 16; ++i) t[i] = (i & 1) ? (t[i - 1] ^ a) : (t[i >> 1] << 1);
+    std::uint64_t lo = 0, hi = 0;
+    for (auto i = 60; i >= 0; i -= 4) {
+        hi = (hi << 4) | (lo >> 60);
+        lo = (lo << 4) ^ t[(b >> i) & 15];
+    }
+    // 表中 `a` 的最高 3 位左移后溢出的部分
+    if ((a >> 63) & 1) hi ^= (b & 0xeeeeeeeeeeeeeeee) >> 1;
+    if ((a >> 62) & 1) hi ^= (b & 0xcccccccccccccccc) >> 2;
+    if ((a >> 61) & 1) hi ^= (b & 0x8888888888888888) >> 3;
+    return std::make_pair(lo, hi);
+}
+
+}
+
+/// \brief 按位压缩的 \f$\mathbb{F}_2\lbrack z\rbrack\f$ 中的多项式, 每个 64 位字存放 64 个系数.
+/// \remarks 加减法为按字异或, 乘法为无进位乘法 (次数较高时使用 Karatsuba), 除法与 gcd 按字并行消元.
+///          内部保证最高的字非零, 零多项式不占用任何字.
+class PolyF2 {
+public:
+    using word_type = std::uint64_t;
+    using value_type = Fp<2>;
+
+    enum : int {
+        NEGATIVE_INFINITY = -1,
+        WORD_BITS = 64,
+        KARATSUBA_THRESHOLD = 16, // 以字为单位
+    };
+
+    constexpr PolyF2() = default;
+    constexpr PolyF2(const PolyF2 &) = default;
+    constexpr PolyF2 &operator=(const PolyF2 &) = default;
+    constexpr PolyF2(std::initializer_list<value_type> l) : PolyF2(l.begin(), l.end()) {}
+    template<std::input_iterator Iter>
+    constexpr PolyF2(Iter a, Iter b) {
+        word_type cur = 0;
+        auto s = 0;
+        for (; a != b; ++a) {
+            if (value_type(*a) != value_type{}) cur |= word_type{1} << s;
+            if (++s == WORD_BITS) w_.push_back(cur), cur = 0, s = 0;
+        }
+        if (s != 0) w_.push_back(cur);
+        shrink();
+    }
+    constexpr explicit PolyF2(const Poly<value_type> &p) : PolyF2(p.cbegin(), p.cend()) {}
+
+    constexpr operator Poly<value_type>() const {
+        const auto d = deg();
+        Poly<value_type> res(d + 1);
+        for (auto i = 0; i <= d; ++i) res[i] = value_type((w_[i / WORD_BITS] >> (i % WORD_BITS)) & 1);
+        return res;
+    }
+
+    /// \brief 以 64 位字构造, 第 \c i 个字的第 \c j 位为 \f$z^{64i+j}\f$ 的系数.
+    static constexpr PolyF2 from_words(std::vector<word_type> w) {
+        PolyF2 res;
+        res.w_ = std::move(w);
+        return res.shrink();
+    }
+    constexpr const auto &words() const { return w_; }
+
+    constexpr int deg() const {
+        if (w_.empty()) return static_cast<int>(NEGATIVE_INFINITY);
+        return static_cast<int>(w_.size()) * WORD_BITS - 1 - std::countl_zero(w_.back());
+    }
+    constexpr PolyF2 &shrink() {
+        while (!w_.empty() && w_.back() == 0) w_.pop_back();
+        return (*this);
+    }
+    /// \brief 首项系数.
+    constexpr value_type lc() const { return w_.empty() ? value_type{} : value_type{1}; }
+    constexpr value_type operator[](int i) const {
+        if (i < 0 || i / WORD_BITS >= static_cast<int>(w_.size())) return value_type{};
+        return value_type((w_[i / WORD_BITS] >> (i % WORD_BITS)) & 1);
+    }
+    constexpr decltype(auto) set(int i, const value_type &v) {
+        const auto k = i / WORD_BITS;
+        const auto mask = word_type{1} << (i % WORD_BITS);
+        if (v != value_type{}) {
+            if (k >= static_cast<int>(w_.size())) w_.resize(k + 1);
+            w_[k] |= mask;
+        } else if (k < static_cast<int>(w_.size())) {
+            w_[k] &= ~mask;
+            shrink();
+        }
+        return (*this);
+    }
+    /// \brief 形式导数.
+    /// \remarks 特征为二, 只有奇数次项保留下来.
+    constexpr auto deriv() const {
+        PolyF2 res(*this);
+        for (auto &&i : res.w_) i = (i >> 1) & 0x5555555555555555;
+        return res.shrink();
+    }
+    constexpr auto operator-() const { return PolyF2(*this); }
+    constexpr PolyF2 &operator+=(const PolyF2 &rhs) {
+        if (w_.size() < rhs.w_.size()) w_.resize(rhs.w_.size());
+        for (auto i = 0, e = static_cast<int>(rhs.w_.size()); i != e; ++i) w_[i] ^= rhs.w_[i];
+        return (shrink());
+    }
+    constexpr PolyF2 &operator-=(const PolyF2 &rhs) { return (*this += rhs); }
+    /// \brief 乘以 \f$z^k\f$.
+    constexpr PolyF2 &operator<<=(int k) {
+        if (w_.empty() || k == 0) return (*this);
+        const auto q = k / WORD_BITS, r = k % WORD_BITS, n = static_cast<int>(w_.size());
+        w_.resize(n + q + 1);
+        for (auto i = n - 1; i >= 0; --i) {
+            const auto v = w_[i];
+            w_[i] = 0;
+            w_[i + q] |= v << r;
+            if (r != 0) w_[i + q + 1] |= v >> (WORD_BITS - r);
+        }
+        return (shrink());
+    }
+    /// \brief 除以 \f$z^k\f$ 并舍去余项.
+    constexpr PolyF2 &operator>>=(int k) {
+        const auto q = k / WORD_BITS, r = k % WORD_BITS, n = static_cast<int>(w_.size());
+        if (q >= n) return (operator=(PolyF2{}));
+        for (auto i = 0; i + q != n; ++i) {
+            w_[i] = w_[i + q] >> r;
+            if (r != 0 && i + q + 1 != n) w_[i] |= w_[i + q + 1] << (WORD_BITS - r);
+        }
+        w_.resize(n - q);
+        return (shrink());
+    }
+    constexpr PolyF2 &operator*=(const PolyF2 &rhs) {
+        if (w_.empty() || rhs.w_.empty()) return (operator=(PolyF2{}));
+        const auto *a = w_.data(), *b = rhs.w_.data();
+        auto n = static_cast<int>(w_.size()), m = static_cast<int>(rhs.w_.size());
+        if (n < m) std::swap(a, b), std::swap(n, m);
+        std::vector<word_type> res(n + m);
+        if (m <= KARATSUBA_THRESHOLD) {
+            mul_basecase(a, n, b, m, res.data());
+        } else {
+            // 将较长的一方按 `m` 个字分块, 每块与另一方做等长的 Karatsuba
+            std::vector<word_type> blk(m), t(2 * m);
+            for (auto i = 0; i < n; i += m) {
+                const auto l = std::min(m, n - i);
+                std::copy(a + i, a + i + l, blk.begin());
+                std::fill(blk.begin() + l, blk.end(), 0);
+                mul_karatsuba(blk.data(), b, m, t.data());
+                for (auto j = 0; j != 2 * m && i + j != n + m; ++j) res[i + j] ^= t[j];
+            }
+        }
+        w_ = std::move(res);
+        return (shrink());
+    }
+    constexpr PolyF2 &operator/=(const PolyF2 &rhs) {
+        PolyF2 quo;
+        reduce(rhs, &quo);
+        return (operator=(quo));
+    }
+    constexpr PolyF2 &operator%=(const PolyF2 &rhs) {
+        reduce(rhs, nullptr);
+        return (*this);
+    }
+
+    constexpr std::pair<PolyF2, PolyF2> div_mod(const PolyF2 &rhs) const {
+        PolyF2 quo, rem(*this);
+        rem.reduce(rhs, &quo);
+        return std::make_pair(quo, rem); // (quotient, remainder)
+    }
+
+    constexpr auto operator()(const value_type &pt) const {
+        if (pt == value_type{}) return operator[](0);
+        auto res = 0;
+        for (auto &&i : w_) res ^= std::popcount(i) & 1;
+        return value_type(res);
+    }
+
+    static constexpr PolyF2 gcd(PolyF2 a, PolyF2 b) {
+        while (b != PolyF2{}) {
+            a %= b;
+            std::swap(a, b);
+        }
+        return a;
+    }
+    static constexpr auto inv_gcd(PolyF2 a, PolyF2 b) {
+        PolyF2 x1{value_type{1}}, x3;
+        while (b != PolyF2{}) {
+            auto [q, r] = a.div_mod(b);
+            std::tie(x1, x3, a, b) = std::make_tuple(x3, x1 - x3 * q, b, r);
+        }
+        // 非零多项式在 `F_2` 上总是首一的
+        if (a == PolyF2{}) throw std::runtime_error("Division by zero");
+        return std::make_pair(x1, a);
+    }
+
+    friend constexpr PolyF2 operator+(const PolyF2 &lhs, const PolyF2 &rhs) { return PolyF2(lhs) += rhs; }
+    friend constexpr PolyF2 operator-(const PolyF2 &lhs, const PolyF2 &rhs) { return PolyF2(lhs) -= rhs; }
+    friend constexpr PolyF2 operator*(const PolyF2 &lhs, const PolyF2 &rhs) { return PolyF2(lhs) *= rhs; }
+    friend constexpr PolyF2 operator/(const PolyF2 &lhs, const PolyF2 &rhs)
+    try { return PolyF2(lhs) /= rhs; } catch(...) { throw; }
+    friend constexpr PolyF2 operator%(const PolyF2 &lhs, const PolyF2 &rhs)
+    try { return PolyF2(lhs) %= rhs; } catch(...) { throw; }
+    friend constexpr PolyF2 operator<<(const PolyF2 &lhs, int rhs) { return PolyF2(lhs) <<= rhs; }
+    friend constexpr PolyF2 operator>>(const PolyF2 &lhs, int rhs) { return PolyF2(lhs) >>= rhs; }
+
+    friend constexpr bool operator==(const PolyF2 &lhs, const PolyF2 &rhs) { return lhs.w_ == rhs.w_; }
+    friend constexpr bool operator!=(const PolyF2 &lhs, const PolyF2 &rhs) { return !(lhs == rhs); }
+
+    friend decltype(auto) operator<<(std::ostream &lhs, const PolyF2 &rhs) {
+        const auto e = rhs.deg() + 1;
+        lhs << '[';
+        for (auto s = 0; s != e; ++s) {
+            lhs << rhs[s];
+            if (s >= 1) lhs << 'z';
+            if (s > 1) lhs << '^' << s;
+            if (s + 1 != e) lhs << " + ";
+        }
+        if (e == 0) lhs << '0';
+        return (lhs << ']');
+    }
+
+private:
+    /// \brief 将 \c a 与 \c b 的乘积异或到 \c r 上, \c r 至少有 \c n+m 个字.
+    static constexpr void mul_basecase(const word_type *a, int n, const word_type *b, int m, word_type *r) {
+        for (auto i = 0; i != n; ++i)
+            if (a[i] != 0)
+                for (auto j = 0; j != m; ++j) {
+                    const auto [lo, hi] = detail::clmul64(a[i], b[j]);
+                    r[i + j] ^= lo;
+                    r[i + j + 1] ^= hi;
+                }
+    }
+    /// \brief 计算两个 \c n 个字的多项式之积, 结果写入 \c r 的 \c 2n 个字.
+    static constexpr void mul_karatsuba(const word_type *a, const word_type *b, int n, word_type *r) {
+        std::fill(r, r + 2 * n, 0);
+        if (n <= KARATSUBA_THRESHOLD) return mul_basecase(a, n, b, n, r);
+        // a = a0 + z^(64h) a1, b = b0 + z^(64h) b1, 其中 a1, b1 有 m >= h 个字
+        const auto h = n / 2, m = n - h;
+        std::vector<word_type> buf(4 * m);
+        auto *sa = buf.data(), *sb = sa + m, *mid = sb + m;
+        for (auto i = 0; i != m; ++i) {
+            sa[i] = a[h + i] ^ (i < h ? a[i] : 0);
+            sb[i] = b[h + i] ^ (i < h ? b[i] : 0);
+        }
+        mul_karatsuba(a, b, h, r);
+        mul_karatsuba(a + h, b + h, m, r + 2 * h);
+        mul_karatsuba(sa, sb, m, mid);
+        for (auto i = 0; i != 2 * h; ++i) mid[i] ^= r[i];
+        for (auto i = 0; i != 2 * m; ++i) mid[i] ^= r[2 * h + i];
+        for (auto i = 0; i != 2 * m; ++i) r[h + i] ^= mid[i];
+    }
+    /// \brief 取出 \c v 中第 \c p 至 \c p+63 位构成的字.
+    static constexpr word_type window(const std::vector<word_type> &v, int p) {
+        const auto k = p / WORD_BITS, r = p % WORD_BITS, n = static_cast<int>(v.size());
+        word_type res = k < n ? v[k] >> r : 0;
+        if (r != 0 && k + 1 < n) res |= v[k + 1] << (WORD_BITS - r);
+        return res;
+    }
+    /// \brief 将 \c src 乘以 \f$z^k\f$ 后异或到 \c dst 上, 超出 \c dst 的部分须为零.
+    static constexpr void xor_shifted(std::vector<word_type> &dst, const std::vector<word_type> &src, int k) {
+        const auto q = k / WORD_BITS, r = k % WORD_BITS, n = static_cast<int>(dst.size());
+        for (auto j = 0, e = static_cast<int>(src.size()); j != e && q + j != n; ++j) {
+            dst[q + j] ^= src[j] << r;
+            if (r != 0 && q + j + 1 != n) dst[q + j + 1] ^= src[j] >> (WORD_BITS - r);
+        }
+    }
+    /// \brief 将 \c *this 替换为模 \c rhs 的余数, 若 \c quo 非空则写入商.
+    /// \remarks 每轮只用 \c rhs 最高的 64 个系数求出商的 64 位, 再用无进位乘法一次消去.
+    constexpr void reduce(const PolyF2 &rhs, PolyF2 *quo) {
+        const auto n = deg(), m = rhs.deg();
+        if (m == NEGATIVE_INFINITY) throw std::runtime_error("Division by zero");
+        if (quo != nullptr) *quo = PolyF2{};
+        if (n < m) return;
+        if (quo != nullptr) quo->w_.assign((n - m) / WORD_BITS + 1, 0);
+        const auto bn = static_cast<int>(rhs.w_.size());
+        // 第 63 位为 `rhs` 的首项系数
+        const auto top = m >= WORD_BITS - 1 ? window(rhs.w_, m - (WORD_BITS - 1))
+                                            : rhs.w_.front() << (WORD_BITS - 1 - m);
+        std::vector<word_type> prod(bn + 1);
+        for (auto i = n; i >= m;) {
+            const auto l = std::min(static_cast<int>(WORD_BITS), i - m + 1), base = i - l + 1, k = base - m;
+            // 高于 `i` 的系数已经为零, 所以 `cur` 的低 `l` 位之外均为零
+            auto cur = window(w_, base);
+            word_type q = 0;
+            for (auto t = l - 1; t >= 0; --t)
+                if ((cur >> t) & 1) q |= word_type{1} << t, cur ^= top >> (WORD_BITS - 1 - t);
+            i = base - 1;
+            if (q == 0) continue;
+            if (quo != nullptr) xor_shifted(quo->w_, {q}, k);
+            std::fill(prod.begin(), prod.end(), 0);
+            for (auto j = 0; j != bn; ++j) {
+                const auto [lo, hi] = detail::clmul64(q, rhs.w_[j]);
+                prod[j] ^= lo;
+                prod[j + 1] ^= hi;
+            }
+            xor_shifted(w_, prod, k);
+        }
+        shrink();
+    }
+
+    std::vector<word_type> w_;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "convolution.hpp"
+#include "polynomial.hpp"
+#include "fp.hpp"
+#include "random.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <span>
+
+namespace {
+
+template<typename F>
+auto run(nttl::StreamConv<F> &conv, const std::vector<F> &x, nttl::xoshiro256starstar &gen) {
+    std::uniform_int_distribution<int> dis(0, 20);
+    std::vector<F> res;
+    // 随机切分输入
+    for (auto i = 0, n = static_cast<int>(x.size()); i < n;) {
+        const auto l = std::min(dis(gen), n - i);
+        auto out = conv.push(std::span<const F>(x.data() + i, l));
+        res.insert(res.end(), out.begin(), out.end());
+        i += l;
+    }
+    auto out = conv.flush();
+    res.insert(res.end(), out.begin(), out.end());
+    return res;
+}
+
+}
+
+TEST(StreamConv, BasicTest) {
+    using F = nttl::Fp<998244353>;
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    std::uniform_int_distribution<int> dis(0, 998244352);
+    for (auto [k, b, t] : {std::make_tuple(5, 8, 1), std::make_tuple(30, 7, 1), std::make_tuple(30, 16, 4)}) {
+        nttl::Poly<F> h;
+        for (auto i = 0; i != k; ++i) h.emplace_back(dis(gen));
+        nttl::StreamConv<F> conv(h, b, t);
+        // 同一对象连续处理两段输入
+        for (auto n : {200, 13}) {
+            std::vector<F> x;
+            for (auto i = 0; i != n; ++i) x.emplace_back(dis(gen));
+            auto y = run(conv, x, gen);
+            EXPECT_EQ(static_cast<int>(y.size()), n + k - 1);
+            EXPECT_EQ(nttl::Poly<F>(y.begin(), y.end()), nttl::Poly<F>(x.begin(), x.end()) * h);
+        }
+    }
+}
+
+TEST(StreamConv, F2Test) {
+    using F = nttl::Fp<2>;
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    std::uniform_int_distribution<int> dis(0, 1);
+    nttl::Poly<F> h;
+    for (auto i = 0; i != 100; ++i) h.emplace_back(dis(gen));
+    h.emplace_back(1);
+    std::vector<F> x;
+    for (auto i = 0; i != 1000; ++i) x.emplace_back(dis(gen));
+    nttl::StreamConv<F> conv(h, 64, 3);
+    auto y = run(conv, x, gen);
+    EXPECT_EQ(nttl::Poly<F>(y.begin(), y.end()), nttl::Poly<F>(x.begin(), x.end()) * h);
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
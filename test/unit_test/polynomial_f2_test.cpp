@@ -0,0 +1,78 @@
+#include "polynomial_f2.hpp"
+#include "polynomial.hpp"
+#include "fq.hpp"
+#include "random.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace {
+
+auto random_poly(nttl::xoshiro256starstar &gen, int n) {
+    std::uniform_int_distribution<int> dis(0, 1);
+    nttl::Poly<nttl::Fp<2>> f;
+    for (auto i = 0; i != n; ++i) f.emplace_back(dis(gen));
+    f.emplace_back(1);
+    return f;
+}
+
+}
+
+TEST(PolyF2, ConversionTest) {
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    for (auto n : {0, 1, 63, 64, 65, 200}) {
+        auto f = random_poly(gen, n);
+        nttl::PolyF2 ff(f);
+        EXPECT_EQ(ff.deg(), f.deg());
+        EXPECT_EQ(nttl::Poly<nttl::Fp<2>>(ff), f) << "Poly -> PolyF2 -> Poly";
+    }
+    EXPECT_EQ(nttl::PolyF2{}.deg(), nttl::PolyF2::NEGATIVE_INFINITY);
+    EXPECT_EQ((nttl::PolyF2{1, 0, 1, 0, 0}).deg(), 2);
+}
+
+TEST(PolyF2, ArithmeticTest) {
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    using P = nttl::Poly<nttl::Fp<2>>;
+    // 后两组的字数超过 Karatsuba 的阈值, 且长度不等
+    for (auto [n, m] : {std::make_pair(100, 70), std::make_pair(130, 1), std::make_pair(1500, 1100),
+                        std::make_pair(2500, 1200)}) {
+        auto f = random_poly(gen, n), g = random_poly(gen, m);
+        nttl::PolyF2 ff(f), gg(g);
+        EXPECT_EQ(P(ff + gg), f + g);
+        EXPECT_EQ(P(ff * gg), f * g);
+        auto [q, r] = ff.div_mod(gg);
+        auto [qq, rr] = f.div_mod(g);
+        EXPECT_EQ(P(q), qq);
+        EXPECT_EQ(P(r), rr);
+        EXPECT_EQ(q * gg + r, ff) << "f == qg + r";
+        EXPECT_EQ(P(ff.deriv()), f.deriv());
+        EXPECT_EQ((ff << 77) >> 77, ff);
+    }
+}
+
+TEST(PolyF2, GcdTest) {
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    auto f = nttl::PolyF2(random_poly(gen, 300)), g = nttl::PolyF2(random_poly(gen, 200)),
+         h = nttl::PolyF2(random_poly(gen, 100));
+    auto d = nttl::PolyF2::gcd(f * h, g * h);
+    EXPECT_EQ(d % h, nttl::PolyF2{}) << "h | gcd(fh, gh)";
+    EXPECT_EQ(f * h % d, nttl::PolyF2{});
+    EXPECT_EQ(g * h % d, nttl::PolyF2{});
+    auto [iv, dd] = nttl::PolyF2::inv_gcd(f, g);
+    EXPECT_EQ(dd, nttl::PolyF2::gcd(f, g));
+    EXPECT_EQ(iv * f % g, dd % g) << "iv * f == gcd(f, g) (mod g)";
+}
+
+TEST(PolyF2, FqTest) {
+    nttl::xoshiro256starstar gen(std::random_device{}());
+    std::uniform_int_distribution<int> dis(0, 1);
+    nttl::F_2_32 a;
+    for (auto i = 0; i != static_cast<int>(a.size()); ++i) a[i] = dis(gen);
+    a[0] = 1;
+    EXPECT_EQ(a * a.inv(), nttl::F_2_32{1});
+    EXPECT_EQ(a.pow((1ll << 32) - 1), nttl::F_2_32{1}) << "a^(q - 1) == 1";
+}
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}